@@ -53,8 +53,8 @@ BSC32=bscmake.exe
 # ADD BASE BSC32 /nologo
 # ADD BSC32 /nologo
 LINK32=link.exe
-# ADD BASE LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib /nologo /dll /machine:I386
-# ADD LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib /nologo /dll /pdb:none /machine:I386 /out:".\a3d.dll"
+# ADD BASE LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib winmm.lib /nologo /dll /machine:I386
+# ADD LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib winmm.lib /nologo /dll /pdb:none /machine:I386 /out:".\a3d.dll"
 # SUBTRACT LINK32 /nodefaultlib
 
 !ELSEIF  "$(CFG)" == "a3d_dll - Win32 Debug"
@@ -81,8 +81,8 @@ BSC32=bscmake.exe
 # ADD BASE BSC32 /nologo
 # ADD BSC32 /nologo
 LINK32=link.exe
-# ADD BASE LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib /nologo /dll /debug /machine:I386 /pdbtype:sept
-# ADD LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib /nologo /dll /profile /debug /debugtype:both /machine:I386 /out:".\a3d.dll"
+# ADD BASE LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib winmm.lib /nologo /dll /debug /machine:I386 /pdbtype:sept
+# ADD LINK32 kernel32.lib user32.lib advapi32.lib shell32.lib ole32.lib dxguid.lib dsound.lib winmm.lib /nologo /dll /profile /debug /debugtype:both /machine:I386 /out:".\a3d.dll"
 # SUBTRACT LINK32 /nodefaultlib
 
 !ENDIF 
@@ -96,6 +96,14 @@ LINK32=link.exe
 # PROP Default_Filter "cpp;c;rc;def;odl;idl;bat"
 # Begin Source File
 
+SOURCE=.\a3d_bat.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_bin.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\a3d_dal.cpp
 # End Source File
 # Begin Source File
@@ -108,14 +116,58 @@ SOURCE=.\a3d_dll.def
 # End Source File
 # Begin Source File
 
+SOURCE=.\a3d_mix.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_nul.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_prf.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_rec.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\a3d_ref.cpp
 # End Source File
+# Begin Source File
+
+SOURCE=.\a3d_sch.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_smp.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_trc.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_vec.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_voi.cpp
+# End Source File
 # End Group
 # Begin Group "Header Files"
 
 # PROP Default_Filter "h;hpp;inl"
 # Begin Source File
 
+SOURCE=.\a3d_bat.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_bin.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\a3d_dal.h
 # End Source File
 # Begin Source File
@@ -124,10 +176,46 @@ SOURCE=.\a3d_dll.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\a3d_mix.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_nul.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_prf.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_rec.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\a3d_ref.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\a3d_sch.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_smp.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_trc.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_vec.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\a3d_voi.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\ia3dapi.h
 # End Source File
 # End Group